@@ -0,0 +1,109 @@
+#pragma once
+
+#include "stdint.h"
+
+/** Address at which the application begins (the bootloader occupies sectors 0 and 1) */
+#define     __BOOT_APP_BASE     (0x08008000U)
+/** Size of the FLASH memory reserved for the application (sectors 2 to 5) */
+#define     __BOOT_APP_SIZE     (0x38000U)
+
+/** Frequency of the clock of USART1 in Hz (the internal oscillator) */
+#define     __BOOT_FREQ         (16000000U)
+/** Baud at which the bootloader begins, and to which it returns if a switch to a higher baud fails */
+#define     __BOOT_BAUD         (115200U)
+/** Highest baud that the host may switch to (1/8th of the clock, with 8x oversampling) */
+#define     __BOOT_MAX_BAUD     (2000000U)
+
+/** Time (in ms) after a reset during which the host can stop the application from being started by sending a SYNC command */
+#define     __BOOT_WAIT_MS      (500)
+/** Time (in ms) after a BAUD command during which the host must send a SYNC command at the new baud */
+#define     __BOOT_SWITCH_MS    (200)
+/** Time (in ms) the bootloader waits for each page of the image before abandoning a WRITE command */
+#define     __BOOT_PAGE_MS      (3000)
+
+/** Number of bytes of the image carried by each page (a multiple of 4 that divides the size of every sector) */
+#define     __BOOT_PAGE_LEN     (1024)
+
+/**
+ * @brief               Commands accepted by the bootloader
+ *
+ *                      Each command is sent as its code followed by the complement of its code, and then its arguments (32-bit values
+ *                      are sent least significant byte first); the bootloader replies to it with BOOT_ACK or BOOT_NAK
+ */
+typedef enum {
+    /** Synchronize with the bootloader (no arguments) */
+    BOOT_CMD_SYNC               = 0x5A,
+    /**
+     * Switch to the baud that follows (32 bits); after the ACK (sent at the current baud), the host must send a SYNC at the new baud
+     * within __BOOT_SWITCH_MS, which is acknowledged at the new baud; otherwise the bootloader returns to the previous baud
+     */
+    BOOT_CMD_BAUD               = 0x42,
+    /**
+     * Write an image of the size (32 bits, a multiple of 4) and CRC (32 bits) that follow into the application area; after the ACK,
+     * the image is sent in pages of __BOOT_PAGE_LEN bytes (the last one padded with 0xFF), each followed by its own CRC (32 bits),
+     * and each page is acknowledged once it has been programmed; the host may send a page before the previous one is acknowledged
+     * (but no further), and the final page is followed by a second reply once the whole image has been verified
+     */
+    BOOT_CMD_WRITE              = 0x57,
+    /** Start the application (no arguments), which is acknowledged before the application is started */
+    BOOT_CMD_GO                 = 0x47,
+} Boot_Cmd_t;
+
+/**
+ * @brief               Replies sent by the bootloader
+ *
+ */
+typedef enum {
+    /** The command (or page) was accepted */
+    BOOT_ACK                    = 0x79,
+    /** The command (or page) was rejected, which abandons a WRITE command */
+    BOOT_NAK                    = 0x1F,
+} Boot_Reply_t;
+
+
+/**
+ * @brief               Initialize the bootloader (USART1 on pins PA9 and PA10 at __BOOT_BAUD, the CRC unit and the DMA controller)
+ *
+ */
+void        BootInit(void);
+
+/**
+ * @brief               Wait for the host to send a SYNC command, which is acknowledged
+ *
+ * @param pMs           The time (in ms) to wait for the command
+ *
+ * @return uint32_t     1 if the command was received, otherwise 0
+ */
+uint32_t    BootWaitSync(uint32_t pMs);
+
+/**
+ * @brief               Check whether a valid application is present (its initial stack pointer lies in SRAM and its reset handler lies in its area)
+ *
+ * @return uint32_t     1 if the application is valid, otherwise 0
+ */
+uint32_t    BootAppValid(void);
+
+/**
+ * @brief               Start the application, after returning the peripherals used by the bootloader to their reset state
+ *
+ * @note                This function does not return
+ */
+void        BootJump(void);
+
+/**
+ * @brief               Serve commands from the host, until it starts the application
+ *
+ * @note                This function does not return
+ */
+void        BootServe(void);
+
+/**
+ * @brief               Compute the CRC of a buffer of words with the CRC unit (CRC-32/MPEG-2, with each word fed most significant byte first)
+ *
+ * @param pBuf          The buffer whose CRC is to be computed
+ * @param pCount        The number of words in the buffer
+ * @param pReset        Whether to begin a new CRC (1), or to continue the CRC of the previous call (0)
+ *
+ * @return uint32_t     The CRC of all words fed since it was begun
+ */
+uint32_t    BootCrc32(const uint32_t *pBuf, uint32_t pCount, uint32_t pReset);
@@ -0,0 +1,483 @@
+#include "stm32f4xx.h"
+#include "ring.h"
+#include "uart.h"
+#include "flash.h"
+#include "boot.h"
+
+#if (__BOOT_PAGE_LEN % 4) != 0 || (0x4000 % __BOOT_PAGE_LEN) != 0
+#error "Length of a page must be a multiple of 4 that divides the size of every sector"
+#endif
+
+/** Number of words in a page */
+#define     BOOT_PAGE_WORDS     (__BOOT_PAGE_LEN / 4)
+/** Number of characters in a frame (a page followed by its CRC) */
+#define     BOOT_FRAME_LEN      (__BOOT_PAGE_LEN + 4)
+
+/** Position of DMA2 Clock Enable Bit */
+#define     RCC_AHB1ENR_DMA2ENn (22)
+/** Position of CRC Clock Enable Bit */
+#define     RCC_AHB1ENR_CRCENn  (12)
+/** Position of DMA2 Reset Bit */
+#define     RCC_AHB1RSTR_DMA2RSTn (22)
+/** Position of CRC Reset Bit */
+#define     RCC_AHB1RSTR_CRCRSTn (12)
+/** Position of USART1 Clock Enable Bit */
+#define     RCC_APB2ENR_USART1ENn (4)
+/** Position of USART1 Reset Bit */
+#define     RCC_APB2RSTR_USART1RSTn (4)
+
+/** DMA stream that serves the RX requests of USART1 (on channel 4) */
+#define     BOOT_DMA_STREAM     DMA2_Stream2
+/** Channel of the DMA stream that is connected to the RX requests of USART1 */
+#define     BOOT_DMA_CHANNEL    (4)
+/** Mask of all flags of the DMA stream in the LISR and LIFCR registers (FIFO error, direct mode error, transfer error, half and full transfer) */
+#define     BOOT_DMA_FLAGS      (0x3DU << 16)
+/** Position of the transfer complete flag of the DMA stream in the LISR and LIFCR registers */
+#define     BOOT_DMA_TCIFn      (21)
+
+/** Position of Channel selection field (3 bits) */
+#define     DMA_SxCR_CHSELn     (25)
+/** Position of Double buffer mode bit */
+#define     DMA_SxCR_DBMn       (18)
+/** Position of Priority level field (2 bits) */
+#define     DMA_SxCR_PLn        (16)
+/** Position of Memory increment mode bit */
+#define     DMA_SxCR_MINCn      (10)
+/** Position of Stream enable bit */
+#define     DMA_SxCR_ENn        (0)
+
+/** Helper macro to set the bit at the specified position */
+#define     BOOT_SET_BIT(v, i)  (v) |= 1U << (i)
+/** Helper macro to clear the bit at the specified position */
+#define     BOOT_CLR_BIT(v, i)  (v) &= ~(1U << (i))
+/** Helper macro to get the bit at the specified index */
+#define     BOOT_GET_BIT(v, i)  (v & (1U << (i)))
+
+
+/** Frame buffers that the DMA fills alternately with the pages of the image (along with their CRCs) */
+static RING_NOINIT uint32_t boot_frame[2][BOOT_FRAME_LEN / 4];
+/** First page of the image, which is only programmed once the whole image has been verified */
+static RING_NOINIT uint32_t boot_first[BOOT_PAGE_WORDS];
+/** Current baud of USART1 */
+static uint32_t             boot_baud = __BOOT_BAUD;
+
+
+static uint32_t
+msElapsed(uint32_t pStart, uint32_t pMs) {
+
+    // this is a utility function to check whether the specified time has elapsed since the cycle counter held the specified value
+    // the subtraction wraps around along with the counter, so it is correct as long as less than 2^32 cycles have elapsed
+
+    return (DWT->CYCCNT - pStart) >= (pMs * (__BOOT_FREQ / 1000U));
+}
+
+static uint32_t
+recvTimeout(Usart_Data_t *pBuf, uint32_t pCount, uint32_t pMs) {
+
+    // this is a utility function to receive an exact number of characters, which fails if they do not all arrive within the specified time
+
+    /** Value of the cycle counter when the wait began */
+    uint32_t    start   = DWT->CYCCNT;
+    /** Number of characters received so far */
+    uint32_t    len     = 0;
+
+    while (len < pCount) {
+        len += USARTRecvBuf(USART_PERIPH_1, &pBuf[len], pCount - len);
+
+        if (len < pCount && msElapsed(start, pMs)) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+static uint32_t
+argGet(const Usart_Data_t *pBuf) {
+    return (uint32_t)pBuf[0] | ((uint32_t)pBuf[1] << 8) | ((uint32_t)pBuf[2] << 16) | ((uint32_t)pBuf[3] << 24);
+}
+
+static void
+reply(Boot_Reply_t pReply) {
+
+    /** The character to be transmitted */
+    Usart_Data_t    c   = (Usart_Data_t)pReply;
+
+    USARTSendBufBlocking(USART_PERIPH_1, &c, 1);
+}
+
+static void
+dmaStart(void) {
+
+    // in double-buffer mode, the stream fills the buffers at M0AR and M1AR alternately (NDTR characters each, starting with M0AR)
+    // without ever stopping, and sets its transfer complete flag every time it fills a buffer
+    // this lets the next frame arrive while the CPU is stalled by erasing or programming the FLASH memory
+    // the stream is used in direct mode (without its FIFO), as each request transfers a single character
+
+    BOOT_DMA_STREAM->CR = 0;
+    while (BOOT_GET_BIT(BOOT_DMA_STREAM->CR, DMA_SxCR_ENn));
+
+    DMA2->LIFCR             = BOOT_DMA_FLAGS;
+    BOOT_DMA_STREAM->PAR    = (uint32_t)&USART1->DR;
+    BOOT_DMA_STREAM->M0AR   = (uint32_t)boot_frame[0];
+    BOOT_DMA_STREAM->M1AR   = (uint32_t)boot_frame[1];
+    BOOT_DMA_STREAM->NDTR   = BOOT_FRAME_LEN;
+    BOOT_DMA_STREAM->FCR    = 0;
+    BOOT_DMA_STREAM->CR     = (BOOT_DMA_CHANNEL << DMA_SxCR_CHSELn) | (1U << DMA_SxCR_DBMn) | (0x2U << DMA_SxCR_PLn) | (1U << DMA_SxCR_MINCn);
+
+    BOOT_SET_BIT(BOOT_DMA_STREAM->CR, DMA_SxCR_ENn);
+}
+
+static void
+dmaStop(void) {
+    BOOT_CLR_BIT(BOOT_DMA_STREAM->CR, DMA_SxCR_ENn);
+    while (BOOT_GET_BIT(BOOT_DMA_STREAM->CR, DMA_SxCR_ENn));
+}
+
+static uint32_t
+flashVerify(uint32_t pAddr, const uint32_t *pBuf, uint32_t pCount) {
+
+    // this is a utility function to compare the programmed contents of the FLASH memory against the buffer they were programmed from
+
+    for (const volatile uint32_t *src = (const volatile uint32_t *)pAddr; pCount; --pCount) {
+        if (*src++ != *pBuf++) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+static Boot_Reply_t
+pageWrite(uint32_t pPage, uint32_t pSize) {
+
+    // the frame of each page is placed in the frame buffers alternately (the first one in buffer 0) by the DMA
+    // as the host never sends more than one page ahead, the frame of the next page can not complete before the transfer complete flag
+    // of this one has been cleared, and can not overwrite this one before it has been acknowledged
+
+    /** Value of the cycle counter when the wait began */
+    uint32_t        start   = DWT->CYCCNT;
+
+    while (!BOOT_GET_BIT(DMA2->LISR, BOOT_DMA_TCIFn)) {
+        if (msElapsed(start, __BOOT_PAGE_MS)) {
+            return BOOT_NAK;
+        }
+    }
+
+    DMA2->LIFCR = 1U << BOOT_DMA_TCIFn;
+
+    /** Frame of the page */
+    const uint32_t  *frame  = boot_frame[pPage & 1];
+    /** Address at which the page is programmed */
+    uint32_t        addr    = __BOOT_APP_BASE + (pPage * __BOOT_PAGE_LEN);
+    /** Number of words of the image in the page (the last page may be partially filled) */
+    uint32_t        words   = (pSize - (pPage * __BOOT_PAGE_LEN)) / 4;
+    /** Sector that holds the page */
+    uint32_t        sector  = FLASHGetSector(addr);
+
+    words = (words < BOOT_PAGE_WORDS) ? words : BOOT_PAGE_WORDS;
+
+    if (BootCrc32(frame, BOOT_PAGE_WORDS, 1) != frame[BOOT_PAGE_WORDS]) {
+        return BOOT_NAK;
+    }
+
+    // a sector is erased when its first page arrives
+    if (FLASHGetSectorBase(sector) == addr && FLASHEraseSector(sector) != FLASH_OK) {
+        return BOOT_NAK;
+    }
+
+    // the first page holds the vector table, so it is kept aside until the whole image has been verified
+    // this way, an interrupted update never leaves behind an application that appears to be valid
+    if (pPage == 0) {
+        for (uint32_t i = 0; i < BOOT_PAGE_WORDS; ++i) {
+            boot_first[i] = frame[i];
+        }
+        return BOOT_ACK;
+    }
+
+    if (FLASHProgram(addr, frame, words) != FLASH_OK || !flashVerify(addr, frame, words)) {
+        return BOOT_NAK;
+    }
+
+    return BOOT_ACK;
+}
+
+static Boot_Reply_t
+imageFinish(uint32_t pSize, uint32_t pCrc) {
+
+    // the CRC of the image is computed over the first page (still held in SRAM) followed by the rest of the image as programmed
+
+    /** Number of words of the image in the first page */
+    uint32_t    words   = (pSize < __BOOT_PAGE_LEN) ? (pSize / 4) : BOOT_PAGE_WORDS;
+    /** CRC of the image */
+    uint32_t    crc     = BootCrc32(boot_first, words, 1);
+
+    if (pSize > __BOOT_PAGE_LEN) {
+        crc = BootCrc32((const uint32_t *)(__BOOT_APP_BASE + __BOOT_PAGE_LEN), (pSize - __BOOT_PAGE_LEN) / 4, 0);
+    }
+
+    if (crc != pCrc) {
+        return BOOT_NAK;
+    }
+
+    if (FLASHProgram(__BOOT_APP_BASE, boot_first, words) != FLASH_OK || !flashVerify(__BOOT_APP_BASE, boot_first, words)) {
+        return BOOT_NAK;
+    }
+
+    return BOOT_ACK;
+}
+
+static void
+cmdBaud(void) {
+
+    // the ACK is sent at the current baud, and must have completely left the shift register before the baud is changed
+    // if the host does not manage to SYNC at the new baud, both sides return to the current baud
+
+    /** Arguments of the command */
+    Usart_Data_t    arg[4];
+
+    if (!recvTimeout(arg, 4, __BOOT_SWITCH_MS)) {
+        reply(BOOT_NAK);
+        return;
+    }
+
+    /** The requested baud */
+    uint32_t        baud    = argGet(arg);
+
+    if (baud < 1200U || baud > __BOOT_MAX_BAUD) {
+        reply(BOOT_NAK);
+        return;
+    }
+
+    reply(BOOT_ACK);
+    USARTFlush(USART_PERIPH_1);
+    USARTSetBaud(USART_PERIPH_1, __BOOT_FREQ, baud);
+
+    if (BootWaitSync(__BOOT_SWITCH_MS)) {
+        boot_baud = baud;
+    }
+    else {
+        USARTSetBaud(USART_PERIPH_1, __BOOT_FREQ, boot_baud);
+    }
+}
+
+static void
+cmdWrite(void) {
+
+    // while the pages are being received, USART1 issues DMA requests instead of RX interrupts
+    // the DMA is armed before the command is acknowledged, as the host begins sending pages as soon as it receives the ACK
+
+    /** Arguments of the command */
+    Usart_Data_t    arg[8];
+
+    if (!recvTimeout(arg, 8, __BOOT_PAGE_MS)) {
+        reply(BOOT_NAK);
+        return;
+    }
+
+    /** Size of the image */
+    uint32_t        size    = argGet(&arg[0]);
+    /** CRC of the image */
+    uint32_t        crc     = argGet(&arg[4]);
+    /** Number of pages in the image */
+    uint32_t        pages   = (size + __BOOT_PAGE_LEN - 1) / __BOOT_PAGE_LEN;
+    /** Result of the last step of the write */
+    Boot_Reply_t    result  = BOOT_ACK;
+
+    if (size == 0 || size > __BOOT_APP_SIZE || (size & 0x3)) {
+        reply(BOOT_NAK);
+        return;
+    }
+
+    USARTDisableRxCallback(USART_PERIPH_1);
+    dmaStart();
+    USARTEnableDmaRx(USART_PERIPH_1);
+    FLASHUnlock();
+
+    reply(BOOT_ACK);
+
+    for (uint32_t i = 0; i < pages && result == BOOT_ACK; ++i) {
+        result = pageWrite(i, size);
+        reply(result);
+    }
+
+    if (result == BOOT_ACK) {
+        reply(imageFinish(size, crc));
+    }
+
+    FLASHLock();
+    USARTDisableDmaRx(USART_PERIPH_1);
+    dmaStop();
+    USARTEnableRxCallback(USART_PERIPH_1);
+}
+
+uint32_t
+BootCrc32(const uint32_t *pBuf, uint32_t pCount, uint32_t pReset) {
+
+    // the CRC unit computes the CRC-32 (polynomial 0x04C11DB7, initial value 0xFFFFFFFF) of every word written to DR,
+    // feeding each word most significant bit first, until it is reset through CR
+
+    if (pReset) {
+        CRC->CR = 1;
+    }
+
+    for (; pCount; --pCount) {
+        CRC->DR = *pBuf++;
+    }
+
+    return CRC->DR;
+}
+
+void
+BootInit(void) {
+
+    // the cycle counter of the DWT unit (which requires trace to be enabled) is used to measure timeouts
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    BOOT_SET_BIT(RCC->AHB1ENR, RCC_AHB1ENR_DMA2ENn);
+    BOOT_SET_BIT(RCC->AHB1ENR, RCC_AHB1ENR_CRCENn);
+
+    USARTEnableClockAccess(USART_PERIPH_1);
+    USARTSetPin(USART1_PA9_PA10);
+    USARTSetBaud(USART_PERIPH_1, __BOOT_FREQ, __BOOT_BAUD);
+    USARTCommEnable(USART_PERIPH_1, USART_RXTX);
+    USARTPeriphEnable(USART_PERIPH_1);
+    USARTEnableRxCallback(USART_PERIPH_1);
+
+    __enable_irq();
+}
+
+uint32_t
+BootWaitSync(uint32_t pMs) {
+
+    // characters that precede the command (such as garbage received while the baud was being changed) are skipped
+
+    /** Value of the cycle counter when the wait began */
+    uint32_t        start   = DWT->CYCCNT;
+    /** The previous and current characters */
+    Usart_Data_t    prev    = 0, c = 0;
+
+    while (!msElapsed(start, pMs)) {
+
+        if (USARTRecvBuf(USART_PERIPH_1, &c, 1)) {
+
+            if (prev == BOOT_CMD_SYNC && c == (Usart_Data_t)(~BOOT_CMD_SYNC & 0xFF)) {
+                reply(BOOT_ACK);
+                return 1;
+            }
+
+            prev = c;
+        }
+    }
+
+    return 0;
+}
+
+uint32_t
+BootAppValid(void) {
+
+    // the vector table of the application begins with its initial stack pointer, followed by the address of its reset handler
+    // both of these words are 0xFFFFFFFF while the application area is erased
+
+    /** Vector table of the application */
+    const uint32_t  *vect   = (const uint32_t *)__BOOT_APP_BASE;
+
+    return ((vect[0] - SRAM1_BASE) <= 0x10000U) && ((vect[1] - __BOOT_APP_BASE) < __BOOT_APP_SIZE);
+}
+
+void
+BootJump(void) {
+
+    // To start the application, the sequence is -
+    // 1. Disable interrupts, and reset the peripherals used by the bootloader (so that the application finds them in their reset state)
+    // 2. Point VTOR at the vector table of the application, so that its own interrupt handlers are used
+    // 3. Load the initial stack pointer of the application into MSP, and branch to its reset handler (with interrupts enabled again,
+    //    as they would be after a reset)
+
+    /** Vector table of the application */
+    const uint32_t  *vect   = (const uint32_t *)__BOOT_APP_BASE;
+
+    __disable_irq();
+    NVIC_DisableIRQ(USART1_IRQn);
+
+    BOOT_SET_BIT(RCC->APB2RSTR, RCC_APB2RSTR_USART1RSTn);
+    BOOT_CLR_BIT(RCC->APB2RSTR, RCC_APB2RSTR_USART1RSTn);
+    BOOT_CLR_BIT(RCC->APB2ENR, RCC_APB2ENR_USART1ENn);
+
+    BOOT_SET_BIT(RCC->AHB1RSTR, RCC_AHB1RSTR_DMA2RSTn);
+    BOOT_SET_BIT(RCC->AHB1RSTR, RCC_AHB1RSTR_CRCRSTn);
+    BOOT_CLR_BIT(RCC->AHB1RSTR, RCC_AHB1RSTR_DMA2RSTn);
+    BOOT_CLR_BIT(RCC->AHB1RSTR, RCC_AHB1RSTR_CRCRSTn);
+    BOOT_CLR_BIT(RCC->AHB1ENR, RCC_AHB1ENR_DMA2ENn);
+    BOOT_CLR_BIT(RCC->AHB1ENR, RCC_AHB1ENR_CRCENn);
+
+    NVIC_ClearPendingIRQ(USART1_IRQn);
+
+    SCB->VTOR = __BOOT_APP_BASE;
+    __DSB();
+    __ISB();
+
+    __set_MSP(vect[0]);
+    __enable_irq();
+
+    ((void (*)(void))vect[1])();
+
+    for (;;) {
+    }
+}
+
+void
+BootServe(void) {
+
+    // a command is recognized when a character is followed by its complement, so stray characters are skipped one at a time
+
+    /** The previous and current characters */
+    Usart_Data_t    prev    = 0, c = 0;
+    /** Whether the previous character can begin a command (it was not part of the previous command) */
+    uint32_t        valid   = 0;
+
+    for (;;) {
+
+        if (!USARTRecvBuf(USART_PERIPH_1, &c, 1)) {
+            continue;
+        }
+
+        if (!valid || c != (Usart_Data_t)(~prev & 0xFF)) {
+            prev    = c;
+            valid   = 1;
+            continue;
+        }
+
+        valid = 0;
+
+        switch (prev) {
+
+            case BOOT_CMD_SYNC:
+                reply(BOOT_ACK);
+                break;
+
+            case BOOT_CMD_BAUD:
+                cmdBaud();
+                break;
+
+            case BOOT_CMD_WRITE:
+                cmdWrite();
+                break;
+
+            case BOOT_CMD_GO:
+                if (!BootAppValid()) {
+                    reply(BOOT_NAK);
+                    break;
+                }
+                reply(BOOT_ACK);
+                USARTFlush(USART_PERIPH_1);
+                BootJump();
+                break;
+
+            default:
+                reply(BOOT_NAK);
+                break;
+        }
+    }
+}
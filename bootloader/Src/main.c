@@ -0,0 +1,16 @@
+#include "stm32f4xx.h"
+#include "boot.h"
+
+int main() {
+
+    BootInit();
+
+    // the application is started unless the host asks for the bootloader right after a reset (or there is no valid application)
+    if (!BootWaitSync(__BOOT_WAIT_MS) && BootAppValid()) {
+        BootJump();
+    }
+
+    BootServe();
+
+    return 0;
+}
@@ -0,0 +1,132 @@
+#!/usr/bin/env python3
+"""
+Upload an application image (a raw binary linked with APP_OFFSET=0x8000) to the bootloader over a serial port.
+
+Usage: upload.py <port> <image.bin> [--baud 2000000] [--go]
+
+Requires pyserial (pip install pyserial). Reset the board right before (or while) running the script, as the bootloader only
+listens for the host for a short time after a reset.
+"""
+
+import argparse
+import struct
+import sys
+import time
+
+import serial
+
+CMD_SYNC = 0x5A
+CMD_BAUD = 0x42
+CMD_WRITE = 0x57
+CMD_GO = 0x47
+
+ACK = 0x79
+NAK = 0x1F
+
+BOOT_BAUD = 115200
+PAGE_LEN = 1024
+# number of pages sent ahead of the acknowledgements (the bootloader holds two pages, one being programmed and one arriving)
+WINDOW = 2
+
+
+def crc32(data):
+    """CRC-32/MPEG-2 of little-endian words, fed most significant bit first (matching the CRC unit of the microcontroller)."""
+    crc = 0xFFFFFFFF
+    for (word,) in struct.iter_unpack("<I", data):
+        crc ^= word
+        for _ in range(32):
+            crc = ((crc << 1) ^ 0x04C11DB7) if crc & 0x80000000 else (crc << 1)
+            crc &= 0xFFFFFFFF
+    return crc
+
+
+def command(code, args=b""):
+    return bytes([code, code ^ 0xFF]) + args
+
+
+def reply(port, what):
+    c = port.read(1)
+    if not c:
+        raise RuntimeError(f"no reply to {what}")
+    if c[0] != ACK:
+        raise RuntimeError(f"{what} rejected (0x{c[0]:02X})")
+
+
+def sync(port, timeout):
+    deadline = time.monotonic() + timeout
+    saved, port.timeout = port.timeout, 0.05
+    try:
+        while time.monotonic() < deadline:
+            port.reset_input_buffer()
+            port.write(command(CMD_SYNC))
+            c = port.read(1)
+            if c and c[0] == ACK:
+                return True
+        return False
+    finally:
+        port.timeout = saved
+
+
+def switch_baud(port, baud):
+    port.write(command(CMD_BAUD, struct.pack("<I", baud)))
+    reply(port, "BAUD")
+    port.flush()
+    port.baudrate = baud
+    # the bootloader returns to the previous baud if no SYNC arrives at the new baud in time
+    if not sync(port, 0.15):
+        port.baudrate = BOOT_BAUD
+        time.sleep(0.1)
+        if not sync(port, 1.0):
+            raise RuntimeError("lost the bootloader while switching the baud")
+        return False
+    return True
+
+
+def write(port, image):
+    image += b"\xFF" * (-len(image) % 4)
+    pages = [image[i:i + PAGE_LEN].ljust(PAGE_LEN, b"\xFF") for i in range(0, len(image), PAGE_LEN)]
+
+    port.write(command(CMD_WRITE, struct.pack("<II", len(image), crc32(image))))
+    reply(port, "WRITE")
+
+    start = time.monotonic()
+    sent = 0
+    for done in range(len(pages)):
+        while sent < len(pages) and sent < done + WINDOW:
+            port.write(pages[sent] + struct.pack("<I", crc32(pages[sent])))
+            sent += 1
+        reply(port, f"page {done}")
+        print(f"\r{done + 1}/{len(pages)} pages", end="", flush=True)
+
+    reply(port, "image verification")
+    print(f"\r{len(pages)} pages ({len(image)} bytes) written in {time.monotonic() - start:.2f} s")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Upload an application image to the UART bootloader")
+    parser.add_argument("port")
+    parser.add_argument("image")
+    parser.add_argument("--baud", type=int, default=2000000, help="baud to switch to for the transfer")
+    parser.add_argument("--go", action="store_true", help="start the application once it is written")
+    args = parser.parse_args()
+
+    with open(args.image, "rb") as f:
+        image = f.read()
+
+    # the reply timeout covers the erase of a 128 KB sector (up to a few seconds) while a page is being programmed
+    with serial.Serial(args.port, BOOT_BAUD, timeout=5.0) as port:
+        if not sync(port, 10.0):
+            sys.exit("bootloader did not respond (reset the board and try again)")
+
+        if args.baud != BOOT_BAUD and not switch_baud(port, args.baud):
+            print(f"could not switch to {args.baud} baud, staying at {BOOT_BAUD} baud")
+
+        write(port, image)
+
+        if args.go:
+            port.write(command(CMD_GO))
+            reply(port, "GO")
+
+
+if __name__ == "__main__":
+    main()